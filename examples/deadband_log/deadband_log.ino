@@ -0,0 +1,67 @@
+/**
+ * Change driven ADC logging, limited to 10 KHz sample frequency.
+ * - connects to ADC
+ * - samples the channel at full rate
+ * - stores only value changes outside the deadband as events
+ * - prints the events with the reconstructed sample time
+ */
+
+#include <SPI.h>
+#include <Mcp320x.h>
+
+#define SPI_CS    	2 		   // SPI slave select
+#define ADC_VREF    3300     // 3.3V Vref
+#define ADC_CLK     1600000  // SPI clock 1.6MHz
+#define SPLS        100000   // samples
+#define SWSPL_FREQ  10000    // sample rate 10 KHz
+#define EVENTS      256      // event buffer size
+#define DEADBAND    8        // ignored raw value change
+#define KEYFRAME    10000    // keyframe every second
+
+
+MCP3208::Event events[EVENTS];
+
+MCP3208 adc(ADC_VREF, SPI_CS);
+
+void setup() {
+
+  // configure PIN mode
+  pinMode(SPI_CS, OUTPUT);
+
+  // set initial PIN state
+  digitalWrite(SPI_CS, HIGH);
+
+  // initialize serial
+  Serial.begin(115200);
+
+  // initialize SPI interface for MCP3208
+  SPISettings settings(ADC_CLK, MSBFIRST, SPI_MODE0);
+  SPI.begin();
+  SPI.beginTransaction(settings);
+}
+
+void loop() {
+
+  // start sampling
+  Serial.println("Reading...");
+
+  uint16_t num = adc.read_deadband(MCP3208::Channel::SINGLE_0, events,
+    SPLS, SWSPL_FREQ, DEADBAND, KEYFRAME);
+
+  Serial.print("Samples: ");
+  Serial.print(SPLS);
+  Serial.print(", events: ");
+  Serial.println(num);
+
+  // reconstruct the sample time from the event deltas
+  uint32_t spl = 0;
+  for (uint16_t i = 0; i < num; i++) {
+    spl += events[i].delta;
+    Serial.print(static_cast<double>(spl) / SWSPL_FREQ, 4);
+    Serial.print("s: ");
+    Serial.print(adc.toAnalog(events[i].value));
+    Serial.println(" mV");
+  }
+
+  delay(2000);
+}
@@ -0,0 +1,104 @@
+/**
+ * SPI framing benchmark.
+ * - connects to ADC
+ * - reads with the legacy byte framing (one transfer call per byte)
+ * - reads with the library word framing
+ * - prints the sample rate of both for each ADC variant
+ *
+ * The timing does not depend on the connected chip, so the
+ * benchmark runs all variants on the same chip select pin.
+ */
+
+#include <SPI.h>
+#include <Mcp320x.h>
+
+#define SPI_CS    	2 		   // SPI slave select
+#define ADC_VREF    3300     // 3.3V Vref
+#define ADC_CLK     1600000  // SPI clock 1.6MHz
+#define SPLS        1024     // samples
+
+
+MCP3201 adc3201(ADC_VREF, SPI_CS);
+MCP3202 adc3202(ADC_VREF, SPI_CS);
+MCP3204 adc3204(ADC_VREF, SPI_CS);
+MCP3208 adc3208(ADC_VREF, SPI_CS);
+
+// legacy MCP3201 read, two byte transfers
+uint16_t readBytes()
+{
+  digitalWrite(SPI_CS, LOW);
+  uint16_t hi = SPI.transfer(0x00) & 0x1F;
+  uint16_t lo = SPI.transfer(0x00);
+  digitalWrite(SPI_CS, HIGH);
+  return ((hi << 8) | lo) >> 1;
+}
+
+// legacy MCP3202/3204/3208 read, three byte transfers
+uint16_t readBytes(uint16_t cmd)
+{
+  digitalWrite(SPI_CS, LOW);
+  SPI.transfer(cmd >> 8);
+  uint16_t hi = SPI.transfer(cmd & 0xFF) & 0x0F;
+  uint16_t lo = SPI.transfer(0x00);
+  digitalWrite(SPI_CS, HIGH);
+  return (hi << 8) | lo;
+}
+
+// sample rate of the legacy byte framing in hz
+uint32_t testBytes(uint16_t cmd, bool hasCmd)
+{
+  uint32_t t1 = micros();
+  for (uint16_t i = 0; i < SPLS; i++)
+    hasCmd ? readBytes(cmd) : readBytes();
+  uint32_t t2 = micros();
+
+  return (1000000ull * SPLS) / (t2 - t1);
+}
+
+void printResult(const char *name, uint32_t bytesFreq, uint32_t wordNs)
+{
+  uint32_t wordFreq = 1000000000ul / wordNs;
+
+  Serial.print(name);
+  Serial.print(": bytes ");
+  Serial.print(bytesFreq);
+  Serial.print(" Hz, words ");
+  Serial.print(wordFreq);
+  Serial.print(" Hz (");
+  Serial.print(static_cast<double>(wordFreq) / bytesFreq, 3);
+  Serial.println("x)");
+}
+
+void setup() {
+
+  // configure PIN mode
+  pinMode(SPI_CS, OUTPUT);
+
+  // set initial PIN state
+  digitalWrite(SPI_CS, HIGH);
+
+  // initialize serial
+  Serial.begin(115200);
+
+  // initialize SPI interface
+  SPISettings settings(ADC_CLK, MSBFIRST, SPI_MODE0);
+  SPI.begin();
+  SPI.beginTransaction(settings);
+}
+
+void loop() {
+
+  Serial.println("Benchmarking...");
+
+  // commands for single channel 0 (see MCP320x::createCmd)
+  printResult("MCP3201", testBytes(0, false),
+    adc3201.testSplSpeed(MCP3201::Channel::SINGLE_0, SPLS));
+  printResult("MCP3202", testBytes(0x01A0, true),
+    adc3202.testSplSpeed(MCP3202::Channel::SINGLE_0, SPLS));
+  printResult("MCP3204", testBytes(0x0600, true),
+    adc3204.testSplSpeed(MCP3204::Channel::SINGLE_0, SPLS));
+  printResult("MCP3208", testBytes(0x0600, true),
+    adc3208.testSplSpeed(MCP3208::Channel::SINGLE_0, SPLS));
+
+  delay(2000);
+}
@@ -7,6 +7,15 @@
 // divide n by d and round to next integer
 #define div_round(n,d) (((n) + ((d) >> 2)) / (d))
 
+// the ESP32 SPI supports words of arbitrary bit length, which allows to
+// transfer a complete 24 bit frame with a single call
+#if defined(ARDUINO_ARCH_ESP32) && !defined(MCP320X_SPI_WORD24)
+#define MCP320X_SPI_WORD24
+#endif
+
+// absolute difference of two unsigned values
+#define abs_diff(a,b) (((a) > (b)) ? ((a) - (b)) : ((b) - (a)))
+
 // channel configurations
 using MCP3201Ch = MCP320xTypes::MCP3201::Channel;
 using MCP3202Ch = MCP320xTypes::MCP3202::Channel;
@@ -36,6 +45,21 @@ uint16_t MCP320x<T>::read(Channel ch) const
   return execute(createCmd(ch));
 }
 
+template <typename T>
+uint16_t MCP320x<T>::readn_deadband(Channel ch, Event *events, uint16_t num,
+  uint32_t spls, uint16_t deadband, uint16_t interval) const
+{
+  return execute(createCmd(ch), events, num, spls, deadband, interval);
+}
+
+template <typename T>
+uint16_t MCP320x<T>::readn_deadband(Channel ch, Event *events, uint16_t num,
+  uint32_t spls, uint32_t splFreq, uint16_t deadband, uint16_t interval)
+{
+  return execute(createCmd(ch), events, num, spls, deadband, interval,
+    getSplDelay(ch, splFreq));
+}
+
 template <typename T>
 uint32_t MCP320x<T>::testSplSpeed(Channel ch) const
 {
@@ -184,24 +208,62 @@ uint16_t MCP3208::execute(Command<MCP3208Ch> cmd) const
 }
 
 template <typename T>
-uint16_t MCP320x<T>::transfer() const
+uint16_t MCP320x<T>::execute(Command<Channel> cmd, Event *events,
+  uint16_t num, uint32_t spls, uint16_t deadband, uint16_t interval) const
 {
-  SpiData adc;
+  uint16_t cnt = 0;
+  uint16_t delta = 0;
+
+  for (uint32_t i = 0; i < spls && cnt < num; i++, delta++) {
+    uint16_t val = execute(cmd);
+    // store first sample, keyframes and changes outside the deadband
+    if (!cnt || delta >= interval
+        || abs_diff(val, events[cnt - 1].value) > deadband) {
+      events[cnt++] = {delta, val};
+      delta = 0;
+    }
+  }
 
+  return cnt;
+}
+
+template <typename T>
+uint16_t MCP320x<T>::execute(Command<Channel> cmd, Event *events,
+  uint16_t num, uint32_t spls, uint16_t deadband, uint16_t interval,
+  uint16_t delay) const
+{
+  uint16_t cnt = 0;
+  uint16_t delta = 0;
+
+  for (uint32_t i = 0; i < spls && cnt < num; i++, delta++) {
+    uint16_t val = execute(cmd);
+    // store first sample, keyframes and changes outside the deadband
+    if (!cnt || delta >= interval
+        || abs_diff(val, events[cnt - 1].value) > deadband) {
+      events[cnt++] = {delta, val};
+      delta = 0;
+    }
+    delayMicroseconds(delay);
+  }
+
+  return cnt;
+}
+
+template <typename T>
+uint16_t MCP320x<T>::transfer() const
+{
   // activate ADC with chip select
   digitalWrite(mCsPin, LOW);
 
-  // receive first(msb) 5 bits
-  adc.hiByte = mSpi->transfer(0x00) & 0x1F;
-  // receive last(lsb) 8 bits
-  adc.loByte = mSpi->transfer(0x00);
+  // receive the complete 15 bit frame with a single 16 bit word
+  // |x|x|0|11|10|9|8|7|6|5|4|3|2|1|0|x|
+  uint16_t adc = mSpi->transfer16(0x0000);
 
   // deactivate ADC with slave select
   digitalWrite(mCsPin, HIGH);
 
   // correct bit offset
-  // |x|x|x|11|10|9|8|7| |6|5|4|3|2|1|0|1
-  return (adc.value >> 1);
+  return (adc >> 1) & 0x0FFF;
 }
 
 template <typename T>
@@ -212,12 +274,18 @@ uint16_t MCP320x<T>::transfer(SpiData cmd) const
   // activate ADC with chip select
   digitalWrite(mCsPin, LOW);
 
-  // send first command byte
-  mSpi->transfer(cmd.hiByte);
-  // send second command byte and receive first(msb) 4 bits
-  adc.hiByte = mSpi->transfer(cmd.loByte) & 0x0F;
+#if defined(MCP320X_SPI_WORD24)
+  // transfer the complete 24 bit frame with a single word, the command
+  // is aligned so that the last data bit is clocked on the last clock
+  uint32_t frame;
+  mSpi->transferBits(static_cast<uint32_t>(cmd.value) << 8, &frame, 24);
+  adc.value = static_cast<uint16_t>(frame) & 0x0FFF;
+#else
+  // send command word and receive first(msb) 4 bits
+  adc.hiByte = mSpi->transfer16(cmd.value) & 0x0F;
   // receive last(lsb) 8 bits
   adc.loByte = mSpi->transfer(0x00);
+#endif
 
   // deactivate ADC with slave select
   digitalWrite(mCsPin, HIGH);
@@ -109,6 +109,16 @@ namespace MCP3208 {
   };
 };
 
+/**
+ * Sample event of a change driven acquisition. The timestamp is stored
+ * as the number of samples since the previous event, which keeps the
+ * event compact while the sample time can still be reconstructed.
+ */
+struct Event {
+  uint16_t delta;  /**< samples since the previous event */
+  uint16_t value;  /**< converted raw value */
+};
+
 }; // namespace MCP320xTypes
 
 template <typename ChannelType>
@@ -124,6 +134,9 @@ public:
   /** ADC Channel configuration. */
   using Channel = ChannelType;
 
+  /** Change driven acquisition event. */
+  using Event = MCP320xTypes::Event;
+
   /**
    * Initiates a MCP320x object. The chip select pin must be already
    * configured as output.
@@ -296,6 +309,93 @@ public:
     execute(cmd, data, num, getSplDelay(ch, splFreq));
   }
 
+  /**
+   * Reads the supplied channel and stores a value change event in the
+   * supplied event array, whenever the value differs from the last
+   * stored value by more than the deadband. The ADC samples at full
+   * rate, the first sample and a keyframe after every interval samples
+   * are always stored. The SPI interface must be initialized and put
+   * in a usable state before calling this function.
+   * @param [in] ch defines the channel to read from.
+   * @param [out] events array to store the events.
+   * @param [in] spls number of samples to acquire.
+   * @param [in] deadband maximum raw value change to be ignored.
+   * @param [in] interval maximum number of samples between two events.
+   * @return the number of stored events.
+   */
+  template <size_t N>
+  uint16_t read_deadband(Channel ch, Event (&events)[N], uint32_t spls,
+    uint16_t deadband, uint16_t interval) const
+  {
+    return readn_deadband(ch, events, N, spls, deadband, interval);
+  }
+
+  /**
+   * Reads the supplied channel limited to the specified frequency and
+   * stores a value change event in the supplied event array, whenever
+   * the value differs from the last stored value by more than the
+   * deadband. The sample rate limit is software controlled, and has a
+   * low precision. The SPI interface must be initialized and put in a
+   * usable state before calling this function.
+   * @param [in] ch defines the channel to read from.
+   * @param [out] events array to store the events.
+   * @param [in] spls number of samples to acquire.
+   * @param [in] splFreq sample frequency limit in hz.
+   * @param [in] deadband maximum raw value change to be ignored.
+   * @param [in] interval maximum number of samples between two events.
+   * @return the number of stored events.
+   */
+  template <size_t N>
+  uint16_t read_deadband(Channel ch, Event (&events)[N], uint32_t spls,
+    uint32_t splFreq, uint16_t deadband, uint16_t interval)
+  {
+    return readn_deadband(ch, events, N, spls, splFreq, deadband, interval);
+  }
+
+  /**
+   * Reads the supplied channel and stores a value change event in the
+   * supplied event array, whenever the value differs from the last
+   * stored value by more than the deadband. The ADC samples at full
+   * rate, the first sample and a keyframe after every interval samples
+   * are always stored. Sampling stops after the requested number of
+   * samples or when the event array is full.
+   * The SPI interface must be initialized and put in a usable state
+   * before calling this function.
+   * @param [in] ch defines the channel to read from.
+   * @param [out] events array to store the events.
+   * @param [in] num maximum number of events. The events array needs
+   * to be at least that size.
+   * @param [in] spls number of samples to acquire.
+   * @param [in] deadband maximum raw value change to be ignored.
+   * @param [in] interval maximum number of samples between two events.
+   * @return the number of stored events.
+   */
+  uint16_t readn_deadband(Channel ch, Event *events, uint16_t num,
+    uint32_t spls, uint16_t deadband, uint16_t interval) const;
+
+  /**
+   * Reads the supplied channel limited to the specified frequency and
+   * stores a value change event in the supplied event array, whenever
+   * the value differs from the last stored value by more than the
+   * deadband. The first sample and a keyframe after every interval
+   * samples are always stored. Sampling stops after the requested
+   * number of samples or when the event array is full. The sample rate
+   * limit is software controlled, and has a low precision.
+   * The SPI interface must be initialized and put in a usable state
+   * before calling this function.
+   * @param [in] ch defines the channel to read from.
+   * @param [out] events array to store the events.
+   * @param [in] num maximum number of events. The events array needs
+   * to be at least that size.
+   * @param [in] spls number of samples to acquire.
+   * @param [in] splFreq sample frequency limit in hz.
+   * @param [in] deadband maximum raw value change to be ignored.
+   * @param [in] interval maximum number of samples between two events.
+   * @return the number of stored events.
+   */
+  uint16_t readn_deadband(Channel ch, Event *events, uint16_t num,
+    uint32_t spls, uint32_t splFreq, uint16_t deadband, uint16_t interval);
+
   /**
    * Performs a sampling speed test over 64 reads. The SPI interface
    * must be initialized and put in a usable state before
@@ -430,13 +530,46 @@ private:
   }
 
   /**
-   * Transfers without SPI command data.
+   * Executes the supplied command for the requested number of samples
+   * and stores only the value change events.
+   * @param [in] cmd the command to execute.
+   * @param [out] events array to store the events.
+   * @param [in] num maximum number of events.
+   * @param [in] spls number of samples to acquire.
+   * @param [in] deadband maximum raw value change to be ignored.
+   * @param [in] interval maximum number of samples between two events.
+   * @return the number of stored events.
+   */
+  uint16_t execute(Command<Channel> cmd, Event *events, uint16_t num,
+    uint32_t spls, uint16_t deadband, uint16_t interval) const;
+
+  /**
+   * Executes the supplied command for the requested number of samples
+   * with delay between reads and stores only the value change events.
+   * @param [in] cmd the command to execute.
+   * @param [out] events array to store the events.
+   * @param [in] num maximum number of events.
+   * @param [in] spls number of samples to acquire.
+   * @param [in] deadband maximum raw value change to be ignored.
+   * @param [in] interval maximum number of samples between two events.
+   * @param [in] delay in us.
+   * @return the number of stored events.
+   */
+  uint16_t execute(Command<Channel> cmd, Event *events, uint16_t num,
+    uint32_t spls, uint16_t deadband, uint16_t interval,
+    uint16_t delay) const;
+
+  /**
+   * Transfers without SPI command data. The 15 bit frame is received
+   * with a single 16 bit word.
    * @return the ADC value from the SPI response.
    */
   uint16_t transfer() const;
 
   /**
-   * Transfers the supplied SPI command data.
+   * Transfers the supplied SPI command data. The 24 bit frame is sent
+   * as one 24 bit word if MCP320X_SPI_WORD24 is defined, otherwise as
+   * a 16 bit command word followed by one byte.
    * @param [in] cmd the SPI command data to transfer.
    * @return the ADC value from the SPI response.
    */